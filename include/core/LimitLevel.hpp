@@ -1,5 +1,6 @@
 #pragma once
 
+#include "core/OrderQueue.hpp"
 #include "types/Order.hpp"
 #include <iostream>
 
@@ -10,33 +11,39 @@ namespace LOB {
         // --- Constructor ---
         explicit LimitLevel(Price price);
 
+        // Reuse a pooled level for a new price without freeing its queue
+        void reset(Price newPrice);
+
         // --- Core Operations ---
         
-        // Appends an order to the end of the list (Time Priority)
+        // Appends an order to the end of the queue (Time Priority)
         void append(Order* order);
 
-        // Removes an order from the list (Cancellation or Execution)
+        // Removes an order from the queue (Cancellation or Execution)
         void remove(Order* order);
 
-        // Decreases tracked volume when an order is partially filled
-        void decreaseVolume(Quantity qty);
+        // Fills a resting order by qty, keeping level volume and queue-ahead in sync
+        void fill(Order* order, Quantity qty);
 
         // --- Getters ---
         Price getPrice() const { return price; }
         Quantity getVolume() const { return totalVolume; }
-        bool isEmpty() const { return head == nullptr; }
+        bool isEmpty() const { return queue.empty(); }
+        uint32_t getOrderCount() const { return queue.size(); }
+
+        // Quantity resting ahead of 'order' in this level (O(log n))
+        Quantity getQueueAhead(const Order* order) const { return queue.volumeAhead(order); }
 
         // Peek at the first order (for execution)
-        Order* getHead() const { return head; }
-        Order* getTail() const { return tail; }
+        Order* getHead() const { return queue.front(); }
+        Order* getTail() const { return queue.back(); }
 
     private:
         Price price;
         Quantity totalVolume; // Total quantity of all orders at this level
 
-        // Pointers to the Linked List
-        Order* head;
-        Order* tail;
+        // Resting orders in time priority (chunked, sequential sweeps)
+        OrderQueue queue;
     };
 
 }
\ No newline at end of file
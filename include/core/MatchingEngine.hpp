@@ -1,5 +1,6 @@
 #pragma once
 #include "types/Order.hpp"
+#include <cstdint>
 
 // We only forward declare OrderBook here to avoid circular includes in headers
 namespace LOB {
@@ -8,12 +9,31 @@ namespace LOB {
 
 namespace LOB {
 
+    // Outcome of an auction uncross.
+    // volume == 0 means the book was not crossed and nothing traded.
+    struct AuctionResult {
+        Price price = 0;
+        uint64_t volume = 0;
+        uint64_t imbalance = 0; // Unmatched demand/supply left at 'price'
+    };
+
     class MatchingEngine {
     public:
         // The main matching logic.
         // Takes an order and the book it belongs to.
         // Returns the remaining quantity of the incoming order.
         static Quantity match(Order* incomingOrder, OrderBook& book);
+
+        // Uncrosses a book accumulated during an auction phase.
+        // Picks the equilibrium price in one pass over cumulative depth
+        // (max volume, then min imbalance, then closest to referencePrice)
+        // and executes all crossing volume at that price in bulk.
+        static AuctionResult uncross(OrderBook& book, Price referencePrice);
+
+    private:
+        // Consumes 'volume' from one side in price-time priority and
+        // erases the emptied levels from the front of that side in one go.
+        static void executeAuctionSide(OrderBook& book, Side side, uint64_t volume);
     };
 
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/LimitLevel.hpp"
+#include "core/MatchingEngine.hpp"
 #include "memory/ObjectPool.hpp"
 #include "memory/LimitLevelPool.hpp"
 #include <vector>
@@ -25,10 +26,26 @@ namespace LOB {
         // Cancels an existing order
         void cancelOrder(OrderId id);
 
+        // --- Auction Phases (Open / Close / Re-open after halt) ---
+
+        // Enters auction mode: new orders rest without matching
+        void startAuction();
+
+        // Ends the auction: executes all crossing volume at the
+        // equilibrium price, then resumes continuous matching
+        AuctionResult uncross(Price referencePrice);
+
+        TradingPhase getPhase() const { return phase; }
+
         // --- Getters (For testing/verification) ---
         Quantity getVolumeAtPrice(Side side, Price price) const;
+        uint32_t getOrderCountAtPrice(Side side, Price price) const;
         bool hasOrder(OrderId id) const;
 
+        // Quantity queued ahead of a resting order at its price level
+        // Returns 0 if the order is not resting
+        Quantity getQueueAhead(OrderId id) const;
+
     private:
         // --- Data Structures ---
         OrderPool orderPool;
@@ -44,6 +61,9 @@ namespace LOB {
         LimitLevel* bestBid {nullptr};
         LimitLevel* bestAsk {nullptr};
 
+        // Continuous matching unless an auction is in progress
+        TradingPhase phase {TradingPhase::Continuous};
+
         // 2. The "Lookup" (Hash Map)
         // Maps OrderID -> Order Pointer. 
         // Allows O(1) access to cancel orders.
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "types/Order.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace LOB {
+
+    // Time-priority queue of the resting orders at one price level.
+    // Order handles are stored in small contiguous chunks, so sweeping the
+    // level reads memory sequentially instead of chasing Order pointers.
+    // Cancelled slots are tombstoned (nullptr) and reclaimed by compaction.
+    // A Fenwick tree over the slots tracks the quantity resting ahead of
+    // any order in O(log n).
+    class OrderQueue {
+    public:
+        // 32 handles per chunk = 256 bytes (4 cache lines)
+        static constexpr uint32_t ChunkShift = 5;
+        static constexpr uint32_t ChunkSize = 1u << ChunkShift;
+
+        OrderQueue() = default;
+        OrderQueue(const OrderQueue&) = delete;
+        OrderQueue& operator=(const OrderQueue&) = delete;
+        OrderQueue(OrderQueue&&) = default;
+        OrderQueue& operator=(OrderQueue&&) = default;
+
+        // Appends at the back (Time Priority)
+        void push(Order* order);
+
+        // O(1) removal through order->queueSlot (Cancellation or Execution)
+        void remove(Order* order);
+
+        // Records a partial fill of a queued order (qty <= order->quantity).
+        // Call before order->fill() so the tree sees the old quantity.
+        void decrease(const Order* order, Quantity qty) { treeSubtract(order->queueSlot, qty); }
+
+        // Quantity of the live orders queued ahead of 'order'
+        Quantity volumeAhead(const Order* order) const { return treePrefix(order->queueSlot); }
+
+        // Drops all handles but keeps the chunks for reuse
+        void clear() { head = tail = liveCount = 0; volumeTree.clear(); }
+
+        // Both ends always hold live orders; tombstones only sit in between
+        Order* front() const { return liveCount ? slot(head) : nullptr; }
+        Order* back() const { return liveCount ? slot(tail - 1) : nullptr; }
+
+        bool empty() const { return liveCount == 0; }
+        uint32_t size() const { return liveCount; }
+
+    private:
+        struct alignas(64) Chunk {
+            Order* slots[ChunkSize];
+        };
+
+        Order*& slot(uint32_t pos) {
+            return chunks[pos >> ChunkShift]->slots[pos & (ChunkSize - 1)];
+        }
+        Order* slot(uint32_t pos) const {
+            return chunks[pos >> ChunkShift]->slots[pos & (ChunkSize - 1)];
+        }
+
+        uint32_t capacity() const { return static_cast<uint32_t>(chunks.size()) << ChunkShift; }
+
+        // Slides live handles down to slot 0 and rewrites their back-references
+        void compact();
+
+        // --- Fenwick tree over slots (node i, 1-based, lives at volumeTree[i - 1]) ---
+
+        // Adds a node for slot 'tail' holding qty
+        void treeAppend(Quantity qty);
+        // Subtracts qty from the slot at pos
+        void treeSubtract(uint32_t pos, Quantity qty);
+        // Sum of the slots in [0, pos)
+        Quantity treePrefix(uint32_t pos) const;
+
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        uint32_t head = 0;      // First live slot
+        uint32_t tail = 0;      // One past the last live slot
+        uint32_t liveCount = 0; // Live orders in [head, tail)
+
+        // Remaining quantity per slot; tombstones hold 0. Sized to 'tail'.
+        std::vector<Quantity> volumeTree;
+    };
+
+}
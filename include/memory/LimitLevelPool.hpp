@@ -29,8 +29,8 @@ public:
         }
         LimitLevel* level = freeList.back();
         freeList.pop_back();
-        // Reinitialize
-        *level = LimitLevel(price);
+        // Reinitialize (keeps the level's queue chunks for reuse)
+        level->reset(price);
         return level;
     }
 
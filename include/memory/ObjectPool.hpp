@@ -45,8 +45,7 @@ namespace LOB {
             order->price = price;
             order->quantity = quantity;
             order->initialQuantity = quantity;
-            order->next = nullptr;
-            order->prev = nullptr;
+            order->queueSlot = 0;
             order->parentLimit = nullptr;
 
             return order;
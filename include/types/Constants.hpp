@@ -13,6 +13,11 @@ enum class OrderType {
     FillOrKill
 };
 
+enum class TradingPhase {
+    Continuous, // Incoming orders match immediately against the book
+    Auction     // Orders accumulate without matching until the uncross
+};
+
 using Price = double;
 using Quantity = uint32_t;
 using OrderId = uint64_t;
\ No newline at end of file
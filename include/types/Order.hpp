@@ -14,11 +14,10 @@ struct Order{
     Quantity quantity;
     Quantity initialQuantity;
     
-    // --- System Pointers (The "Intrusive" Linked List) ---
-    // These pointers allow the Order to act as a node in a list.
-    // By storing them here, we avoid allocating a separate "Node" object.
-    Order* next = nullptr; // Pointer to the next order in the list
-    Order* prev = nullptr; // Pointer to the previous order in the list
+    // --- Queue Back-Reference ---
+    // Index of this order's slot in its level's chunked OrderQueue.
+    // Lets a cancel tombstone the slot in O(1) without searching.
+    uint32_t queueSlot = 0;
 
     // Pointer to the Price Level this order belongs to.
     // Needed so we can quickly update the limit's volume when this order is cancelled.
@@ -3,7 +3,13 @@
 namespace LOB {
 
     LimitLevel::LimitLevel(Price price) 
-        : price(price), totalVolume(0), head(nullptr), tail(nullptr) {}
+        : price(price), totalVolume(0) {}
+
+    void LimitLevel::reset(Price newPrice) {
+        price = newPrice;
+        totalVolume = 0;
+        queue.clear();
+    }
 
     void LimitLevel::append(Order* order) {
         // 1. Sanity check: If order is null, return.
@@ -17,19 +23,8 @@ namespace LOB {
         // 3. Update the totalVolume of this level.
         totalVolume += order->quantity;
 
-        // 4. Linked List Logic:
-        if(head == nullptr){
-            head = order;
-            tail = order;
-            order-> next = nullptr;
-            order-> prev = nullptr;
-        }   
-        else{
-            tail -> next = order;
-            order -> prev = tail;
-            order -> next = nullptr;
-            tail = order;
-        }
+        // 4. Queue the handle (stores the slot back-reference in the order)
+        queue.push(order);
         return;
     }
 
@@ -41,37 +36,23 @@ namespace LOB {
         // 2. Decrease totalVolume by order->quantity.
         totalVolume -= order -> quantity;
         
-        // 3. Update Pointers (The Surgical Removal):
-       
-        // Handle the 'prev' pointer
-        if (order-> prev != nullptr){
-            order -> prev -> next = order -> next;
-        }
-        else{
-            head = order -> next;
-        }
-        
-        // Handle the 'next' pointer
-        if (order -> next != nullptr){
-            order -> next -> prev = order -> prev;
-        }
-        else{
-            tail = order -> prev;
-        }
+        // 3. Tombstone the order's slot (O(1) via its back-reference)
+        queue.remove(order);
 
         // 4. Cleanup: 
         order -> parentLimit = nullptr;
-        order -> next = nullptr;
-        order -> prev = nullptr;
         
         return;
     }
 
-    void LimitLevel::decreaseVolume(Quantity qty) {
-        if (qty >= totalVolume) {
-            totalVolume = 0;
-        } else {
-            totalVolume -= qty;
+    void LimitLevel::fill(Order* order, Quantity qty) {
+        // Clamp to what the order has left
+        if (qty > order->quantity) {
+            qty = order->quantity;
         }
+
+        totalVolume -= qty;
+        queue.decrease(order, qty);
+        order->fill(qty);
     }
 }
\ No newline at end of file
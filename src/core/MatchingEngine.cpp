@@ -3,6 +3,7 @@
 #include "core/LimitLevel.hpp"
 #include <iostream>
 #include <algorithm> // For std::min
+#include <cmath>     // For std::abs
 
 namespace LOB {
 
@@ -36,7 +37,7 @@ namespace LOB {
 
             while (bookOrder != nullptr && qty > 0) {
                 Quantity tradeQty = std::min(qty, bookOrder->quantity);
-                bestLevel->decreaseVolume(tradeQty);
+                bestLevel->fill(bookOrder, tradeQty);
 
                 // --- EXECUTION (Log trade) ---
                 // PERFORMANCE NOTE: Comment this out when running benchmarks!
@@ -44,13 +45,10 @@ namespace LOB {
 
                 // Update Quantities
                 qty -= tradeQty;
-                bookOrder->fill(tradeQty);
-
-                Order* nextOrder = bookOrder->next;
 
                 // 6. If book order is empty, clean it up
                 if (bookOrder->isFilled()) {
-                    // Remove from Linked List
+                    // Tombstone its queue slot (head advances to the next order)
                     bestLevel->remove(bookOrder);
                     
                     
@@ -62,7 +60,8 @@ namespace LOB {
                     book.orderPool.deallocate(bookOrder);
                 }
 
-                bookOrder = nextOrder;
+                // Next in time priority is the (possibly unchanged) head
+                bookOrder = bestLevel->getHead();
             }
 
             // 7. Clean up the Price Level if it's now empty
@@ -74,4 +73,112 @@ namespace LOB {
 
         return qty;
     }
-}
\ No newline at end of file
+
+    AuctionResult MatchingEngine::uncross(OrderBook& book, Price referencePrice) {
+        AuctionResult result;
+
+        // 1. Nothing to do unless the book is crossed
+        if (book.bestBid == nullptr || book.bestAsk == nullptr) return result;
+        Price highestBid = book.bestBid->getPrice();
+        Price lowestAsk = book.bestAsk->getPrice();
+        if (highestBid < lowestAsk) return result;
+
+        // 2. Supply available at the highest candidate price (asks <= best bid).
+        // Only prices in [lowestAsk, highestBid] can execute, so this is a prefix.
+        const auto& bids = book.bids;
+        const auto& asks = book.asks;
+        size_t ai = 0;
+        uint64_t supply = 0;
+        while (ai < asks.size() && asks[ai].first <= highestBid) {
+            supply += asks[ai].second->getVolume();
+            ++ai;
+        }
+
+        // 3. Single descending pass over the merged candidate prices.
+        // Demand(p) = bids with price >= p (grows as we descend)
+        // Supply(p) = asks with price <= p (shrinks as we descend)
+        size_t bi = 0;
+        uint64_t demand = 0;
+        bool found = false;
+        while (ai > 0) {
+            Price p = asks[ai - 1].first;
+            if (bi < bids.size() && bids[bi].first > p) p = bids[bi].first;
+
+            while (bi < bids.size() && bids[bi].first >= p) {
+                demand += bids[bi].second->getVolume();
+                ++bi;
+            }
+
+            uint64_t volume = std::min(demand, supply);
+            uint64_t imbalance = (demand > supply) ? demand - supply : supply - demand;
+
+            // Max volume, then min imbalance, then closest to the reference price.
+            // Remaining ties keep the higher price (first seen).
+            bool better = !found
+                || volume > result.volume
+                || (volume == result.volume && imbalance < result.imbalance)
+                || (volume == result.volume && imbalance == result.imbalance
+                    && std::abs(p - referencePrice) < std::abs(result.price - referencePrice));
+            if (better) {
+                result.price = p;
+                result.volume = volume;
+                result.imbalance = imbalance;
+                found = true;
+            }
+
+            // Asks at p are not available below p
+            while (ai > 0 && asks[ai - 1].first >= p) {
+                supply -= asks[ai - 1].second->getVolume();
+                --ai;
+            }
+        }
+
+        if (result.volume == 0) return result;
+
+        // 4. Bulk execution: both sides give up exactly 'volume' in priority order.
+        // Every crossing order trades at the single equilibrium price.
+        executeAuctionSide(book, Side::Buy, result.volume);
+        executeAuctionSide(book, Side::Sell, result.volume);
+        book.refreshBestPointers();
+
+        return result;
+    }
+
+    void MatchingEngine::executeAuctionSide(OrderBook& book, Side side, uint64_t volume) {
+        auto& levels = (side == Side::Buy) ? book.bids : book.asks;
+        size_t emptied = 0;
+
+        while (volume > 0 && emptied < levels.size()) {
+            LimitLevel* level = levels[emptied].second;
+            Order* bookOrder = level->getHead();
+
+            while (bookOrder != nullptr && volume > 0) {
+                Quantity tradeQty = static_cast<Quantity>(
+                    std::min<uint64_t>(volume, bookOrder->quantity));
+                level->fill(bookOrder, tradeQty);
+                volume -= tradeQty;
+
+                if (bookOrder->isFilled()) {
+                    level->remove(bookOrder);
+
+                    if (bookOrder->id < book.orderLookup.size()) {
+                        book.orderLookup[bookOrder->id] = nullptr;
+                    }
+
+                    book.orderPool.deallocate(bookOrder);
+                }
+
+                bookOrder = level->getHead();
+            }
+
+            // A partially consumed level stays; it is the new best
+            if (!level->isEmpty()) break;
+
+            book.levelPool.deallocate(level);
+            ++emptied;
+        }
+
+        // Emptied levels are a prefix of the sorted side: erase them at once
+        levels.erase(levels.begin(), levels.begin() + emptied);
+    }
+}
@@ -25,7 +25,10 @@ namespace LOB {
         Order* order = orderPool.allocate(id, side, price, quantity);
 
         // Step 3: Match Immediately (Market Taker)
-        Quantity remainingQty = MatchingEngine::match(order, *this);
+        // During an auction orders only accumulate; the uncross matches them.
+        Quantity remainingQty = (phase == TradingPhase::Continuous)
+            ? MatchingEngine::match(order, *this)
+            : quantity;
         
         // Step 4: Update the Order
         order->quantity = remainingQty;
@@ -85,15 +88,38 @@ namespace LOB {
         orderPool.deallocate(order);
     }
 
+    void OrderBook::startAuction() {
+        phase = TradingPhase::Auction;
+    }
+
+    AuctionResult OrderBook::uncross(Price referencePrice) {
+        AuctionResult result = MatchingEngine::uncross(*this, referencePrice);
+        phase = TradingPhase::Continuous;
+        return result;
+    }
+
     Quantity OrderBook::getVolumeAtPrice(Side side, Price price) const {
         LimitLevel* lvl = findLevel(side, price);
         return (lvl == nullptr) ? 0 : lvl->getVolume();
     }
 
+    uint32_t OrderBook::getOrderCountAtPrice(Side side, Price price) const {
+        LimitLevel* lvl = findLevel(side, price);
+        return (lvl == nullptr) ? 0 : lvl->getOrderCount();
+    }
+
     bool OrderBook::hasOrder(OrderId id) const {
         return id < orderLookup.size() && orderLookup[id] != nullptr;
     }
 
+    Quantity OrderBook::getQueueAhead(OrderId id) const {
+        if (!hasOrder(id)) {
+            return 0;
+        }
+        const Order* order = orderLookup[id];
+        return order->parentLimit->getQueueAhead(order);
+    }
+
     LimitLevel* OrderBook::getBestLevel(Side side) const {
         return (side == Side::Buy) ? bestAsk : bestBid;
     }
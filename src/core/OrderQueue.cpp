@@ -0,0 +1,110 @@
+#include "core/OrderQueue.hpp"
+
+namespace LOB {
+
+    void OrderQueue::push(Order* order) {
+        // 1. Out of slots: reclaim tombstones if they make up half the
+        // capacity, otherwise grow by one chunk
+        if (tail == capacity()) {
+            uint32_t dead = tail - liveCount;
+            if (dead > 0 && dead >= capacity() / 2) {
+                compact();
+            } else {
+                chunks.push_back(std::make_unique<Chunk>());
+            }
+        }
+
+        // 2. Store the handle and the back-reference used by remove()
+        order->queueSlot = tail;
+        slot(tail) = order;
+        treeAppend(order->quantity);
+        ++tail;
+        ++liveCount;
+    }
+
+    void OrderQueue::remove(Order* order) {
+        uint32_t pos = order->queueSlot;
+
+        // 1. Lazy deletion: tombstone the slot and drop its remaining quantity
+        slot(pos) = nullptr;
+        treeSubtract(pos, order->quantity);
+        --liveCount;
+
+        // 2. Empty queue: rewind for free
+        if (liveCount == 0) {
+            clear();
+            return;
+        }
+
+        // 3. Keep both ends on live orders. Each tombstone is skipped once.
+        if (pos == head) {
+            do { ++head; } while (slot(head) == nullptr);
+
+            // Prefetch the order behind the new head; the next fill touches it
+#if defined(__GNUC__)
+            if (head + 1 < tail) {
+                __builtin_prefetch(slot(head + 1));
+            }
+#endif
+        } else if (pos == tail - 1) {
+            do { --tail; } while (slot(tail - 1) == nullptr);
+            // Nodes past 'tail' only cover dead slots
+            volumeTree.resize(tail);
+        }
+
+        // 4. Interior tombstones outnumber live orders: compact
+        uint32_t span = tail - head;
+        if (span >= ChunkSize && span - liveCount > liveCount) {
+            compact();
+        }
+    }
+
+    void OrderQueue::compact() {
+        uint32_t out = 0;
+        volumeTree.clear();
+        for (uint32_t pos = head; pos < tail; ++pos) {
+            Order* order = slot(pos);
+            if (order == nullptr) continue;
+            order->queueSlot = out;
+            slot(out++) = order;
+            volumeTree.push_back(order->quantity);
+        }
+        head = 0;
+        tail = out;
+
+        // Linear Fenwick build: push each node's sum into its parent
+        for (uint32_t i = 1; i <= out; ++i) {
+            uint32_t parent = i + (i & (0u - i));
+            if (parent <= out) {
+                volumeTree[parent - 1] += volumeTree[i - 1];
+            }
+        }
+    }
+
+    void OrderQueue::treeAppend(Quantity qty) {
+        // Node i covers slots (i - lowbit(i), i]; its children are i-1, i-2, i-4, ...
+        uint32_t i = static_cast<uint32_t>(volumeTree.size()) + 1;
+        uint32_t lowbit = i & (0u - i);
+        Quantity sum = qty;
+        for (uint32_t k = 1; k < lowbit; k <<= 1) {
+            sum += volumeTree[i - k - 1];
+        }
+        volumeTree.push_back(sum);
+    }
+
+    void OrderQueue::treeSubtract(uint32_t pos, Quantity qty) {
+        uint32_t n = static_cast<uint32_t>(volumeTree.size());
+        for (uint32_t i = pos + 1; i <= n; i += i & (0u - i)) {
+            volumeTree[i - 1] -= qty;
+        }
+    }
+
+    Quantity OrderQueue::treePrefix(uint32_t pos) const {
+        Quantity sum = 0;
+        for (uint32_t i = pos; i > 0; i -= i & (0u - i)) {
+            sum += volumeTree[i - 1];
+        }
+        return sum;
+    }
+
+}